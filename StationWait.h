@@ -5,15 +5,30 @@
 #ifndef CS3210_ASSIGNMENT1_STATIONWAIT_H
 #define CS3210_ASSIGNMENT1_STATIONWAIT_H
 
-#endif //CS3210_ASSIGNMENT1_STATIONWAIT_H
+#include <limits.h>
+#include <stdint.h>
+
+/**
+ * Every field is bounded by the number of ticks simulated, so compact mode stores them as 16-bit counters and main
+ * rejects inputs with more ticks than that.
+ */
+#ifdef COMPACT_MODE
+#define STATION_WAIT_TIME_MAX UINT16_MAX
+typedef uint16_t station_time_t;
+#else
+#define STATION_WAIT_TIME_MAX UINT_MAX
+typedef unsigned int station_time_t;
+#endif
 
 typedef struct {
-    unsigned int total_wait_time;
-    unsigned int min_wait_time;
-    unsigned int max_wait_time;
-    unsigned int num_trains_arrive;
-    unsigned int prev_time_stamp;
+    station_time_t total_wait_time;
+    station_time_t min_wait_time;
+    station_time_t max_wait_time;
+    station_time_t num_trains_arrive;
+    station_time_t prev_time_stamp;
 } StationWait;
 
 void train_arrive(unsigned int time, StationWait* station_wait);
 void train_leave(unsigned int time, StationWait* stationWait);
+
+#endif //CS3210_ASSIGNMENT1_STATIONWAIT_H
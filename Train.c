@@ -3,3 +3,43 @@
 //
 
 #include "Train.h"
+
+/**
+ * Converts a whole number of ticks into the train's time representation. In compact mode anything beyond
+ * TRAIN_MAX_TICKS saturates, which still outlasts every run compact mode accepts. This covers the zero-cost self-link
+ * taken at the end of a line, where cost - 1 wraps around to UINT_MAX.
+ * */
+train_time_t train_time_from_ticks(unsigned int ticks)
+{
+#ifdef COMPACT_MODE
+    if (ticks > TRAIN_MAX_TICKS) {
+        ticks = TRAIN_MAX_TICKS;
+    }
+    return ((train_time_t) ticks) * TRAIN_TIME_ONE;
+#else
+    return ticks;
+#endif
+}
+
+/**
+ * Converts a fractional number of ticks into the train's time representation. In compact mode this rounds up, so a
+ * loading countdown reaches zero on the same tick as it would with the float representation. Out of range values
+ * saturate at TRAIN_MAX_TICKS instead of overflowing the integer conversion.
+ * */
+train_time_t train_time_from_float(float ticks)
+{
+#ifdef COMPACT_MODE
+    if (!(ticks < TRAIN_MAX_TICKS)) {
+        return train_time_from_ticks(TRAIN_MAX_TICKS);
+    }
+    if (ticks < -TRAIN_MAX_TICKS) {
+        return -train_time_from_ticks(TRAIN_MAX_TICKS);
+    }
+
+    float scaled = ticks * TRAIN_TIME_ONE;
+    train_time_t fixed = (train_time_t) scaled;
+    return (fixed < scaled) ? (fixed + 1) : fixed;
+#else
+    return ticks;
+#endif
+}
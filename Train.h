@@ -5,15 +5,50 @@
 #ifndef CS3210_ASSIGNMENT1_TRAIN_H
 #define CS3210_ASSIGNMENT1_TRAIN_H
 
-#endif //CS3210_ASSIGNMENT1_TRAIN_H
+#include <stdint.h>
 
 enum TrainStatus {WAIT_TO_LOAD, LOADING, LOADED, LINK};
 
+#ifdef COMPACT_MODE
+
+/**
+ * In compact mode the time left is a fixed-point integer with TRAIN_TIME_FRAC_BITS fractional bits, so one tick is
+ * TRAIN_TIME_ONE. The remaining fields are narrowed to the sizes main checks the input against before simulating.
+ */
+#define TRAIN_TIME_FRAC_BITS 8
+#define TRAIN_TIME_ONE (1 << TRAIN_TIME_FRAC_BITS)
+#define TRAIN_MAX_TICKS (INT32_MAX >> TRAIN_TIME_FRAC_BITS)
+#define TRAIN_MAX_NODES UINT16_MAX
+
+typedef int32_t train_time_t;
+
+typedef struct {
+    train_time_t time_left;
+    uint32_t train_id;
+    uint16_t node_idx;
+    uint8_t line_id;
+    uint8_t train_status : 2;
+    uint8_t has_acted : 1;
+} Train;
+
+#else
+
+#define TRAIN_TIME_ONE 1
+
+typedef float train_time_t;
+
 typedef struct {
     unsigned int line_id;
     unsigned int train_id;
     unsigned int node_idx;
-    float time_left;
+    train_time_t time_left;
     enum TrainStatus train_status;
     unsigned char has_acted;
-} Train;
\ No newline at end of file
+} Train;
+
+#endif
+
+train_time_t train_time_from_ticks(unsigned int ticks);
+train_time_t train_time_from_float(float ticks);
+
+#endif //CS3210_ASSIGNMENT1_TRAIN_H
@@ -20,6 +20,10 @@ unsigned int* get_num_trains_per_line(unsigned int num_lines);
 void read_inputs(const unsigned int NUM_LINES, unsigned int *num_stations, char ***station_names,
         unsigned int ***link_costs, float **station_popularity_list, char ****stations_in_lines,
         unsigned int **num_stations_per_line, unsigned int *num_ticks, unsigned int **num_trains_per_line);
+#ifdef COMPACT_MODE
+unsigned char fits_compact_mode(const unsigned int NUM_LINES, unsigned int *num_stations_per_line,
+        unsigned int num_ticks);
+#endif
 
 int main() {
     const unsigned int TRAIN_SPEED = 1;
@@ -48,6 +52,13 @@ int main() {
     read_inputs(NUM_LINES, &num_stations, &station_names, &link_costs, &station_popularity, &stations_in_lines,
                 &num_stations_per_line, &num_ticks, &num_trains_per_line);
 
+#ifdef COMPACT_MODE
+    if (!fits_compact_mode(NUM_LINES, num_stations_per_line, num_ticks)) {
+        fprintf(stderr, "Input is too large for compact mode, rebuild without COMPACT_MODE.\n");
+        return EXIT_FAILURE;
+    }
+#endif
+
     ///////////////////
     // Model Problem //
     ///////////////////
@@ -75,7 +86,14 @@ int main() {
     unsigned int count = 0;
     for (unsigned int i = 0; i < NUM_LINES; i++) {
         for (unsigned int j = 0; j < num_trains_per_line[i]; j++) {
-            trains[count++] = (Train){i, j, (j % 2 == 0) ? 0 : (num_stations_per_line[i]), 1, WAIT_TO_LOAD, 0};
+            trains[count++] = (Train){
+                .line_id = i,
+                .train_id = j,
+                .node_idx = (j % 2 == 0) ? 0 : (num_stations_per_line[i]),
+                .time_left = TRAIN_TIME_ONE,
+                .train_status = WAIT_TO_LOAD,
+                .has_acted = 0
+            };
         }
     }
 
@@ -101,11 +119,12 @@ int main() {
     }
 
     // Model Problem for Part 2
-    StationWait** station_waits = malloc(sizeof(StationWait*) * num_station_sides);
+    // Each node of a line is a distinct station side, so a line only keeps statistics for the nodes it serves.
+    StationWait** station_waits = malloc(sizeof(StationWait*) * NUM_LINES);
     for (unsigned int i = 0; i < NUM_LINES; i++) {
-        station_waits[i] = malloc(sizeof(StationWait) * num_station_sides);
-        for (unsigned int j = 0; j < num_station_sides; j++) {
-            station_waits[i][j] = (StationWait) {0, UINT_MAX, 0, 0, 0};
+        station_waits[i] = malloc(sizeof(StationWait) * networks[i]->num_nodes);
+        for (unsigned int j = 0; j < networks[i]->num_nodes; j++) {
+            station_waits[i][j] = (StationWait) {0, STATION_WAIT_TIME_MAX, 0, 0, 0};
         }
     }
 
@@ -127,7 +146,7 @@ int main() {
                     unsigned int curr_station_idx = get_station_idx(networks[trains[i].line_id], trains[i].node_idx);
                     unsigned int next_station_idx = get_station_idx(networks[trains[i].line_id], next_node_idx);
 
-                    train_leave(t, &station_waits[trains[i].line_id][curr_station_idx]);
+                    train_leave(t, &station_waits[trains[i].line_id][trains[i].node_idx]);
 
                     if ((trains[i].train_status == LOADING) && (curr_station_idx != (next_station_idx - num_stations))) {
                         // Finish serving commuters at the station.
@@ -152,7 +171,7 @@ int main() {
 
             // Step 2: Trains holding lock release first if possible.
             if ((trains[i].train_status == LOADING) || (trains[i].train_status == LINK)) {
-                trains[i].time_left -= 1;
+                trains[i].time_left -= TRAIN_TIME_ONE;
 
                 // Release lock and transition
                 if (trains[i].time_left <= 0) {
@@ -161,7 +180,7 @@ int main() {
                     unsigned int curr_station_idx = get_station_idx(networks[trains[i].line_id], trains[i].node_idx);
                     unsigned int next_station_idx = get_station_idx(networks[trains[i].line_id], next_node_idx);
 
-                    train_leave(t, &station_waits[trains[i].line_id][curr_station_idx]);
+                    train_leave(t, &station_waits[trains[i].line_id][trains[i].node_idx]);
 
                     if ((trains[i].train_status == LOADING) && (curr_station_idx != (next_station_idx - num_stations))) {
                         // Finish serving commuters at the station.
@@ -195,10 +214,10 @@ int main() {
                     if (omp_test_lock(lock_ptr)) {
                         // Successfully acquired lock, begin loading
                         trains[i].train_status = LOADING;
-                        trains[i].time_left = station_popularity[station_idx] *
-                                ((float) ((rand() % STATION_WAITING_RANGE) + STATION_WAITING_MIN)) - 1;
+                        trains[i].time_left = train_time_from_float(station_popularity[station_idx] *
+                                ((float) ((rand() % STATION_WAITING_RANGE) + STATION_WAITING_MIN))) - TRAIN_TIME_ONE;
                         train_lock_ptrs[i] = lock_ptr;
-                        train_arrive(t, &station_waits[trains[i].line_id][station_idx]);
+                        train_arrive(t, &station_waits[trains[i].line_id][trains[i].node_idx]);
                     }
 
                 } else if (trains[i].train_status == LOADED) {
@@ -219,7 +238,7 @@ int main() {
                         // Suceessfully acquired lock.
                         trains[i].train_status = LINK;
                         train_lock_ptrs[i] = link_lock_ptr;
-                        trains[i].time_left = link_costs[curr_station_id][next_station_id] - 1;
+                        trains[i].time_left = train_time_from_ticks(link_costs[curr_station_id][next_station_id] - 1);
                     }
                 }
 
@@ -271,8 +290,7 @@ int main() {
         unsigned int total_max = 0;
         unsigned int total_valid_minmax = 0;
         for (unsigned int j = 0; j < ((*networks[i]).num_nodes); j++) {
-            unsigned int station_idx = get_station_idx(networks[i], j);
-            StationWait* station_wait = &station_waits[i][station_idx];
+            StationWait* station_wait = &station_waits[i][j];
             if (station_wait->num_trains_arrive > 0) {
                 average_waiting_time += station_wait->total_wait_time;
                 num_waiting_count += station_wait->num_trains_arrive;
@@ -312,6 +330,12 @@ int main() {
     free(trains);
     trains = NULL;
 
+    for (unsigned int i = 0; i < NUM_LINES; i++) {
+        free(station_waits[i]);
+    }
+    free(station_waits);
+    station_waits = NULL;
+
 
     for (unsigned int i = 0; i < NUM_LINES; i++) {
         delete_line_network(networks[i]);
@@ -400,6 +424,27 @@ void read_inputs(const unsigned int NUM_LINES, unsigned int *num_stations, char
     printf("\n");
 }
 
+#ifdef COMPACT_MODE
+/**
+ * Checks that the input fits the narrowed fields used in compact mode.
+ */
+unsigned char fits_compact_mode(const unsigned int NUM_LINES, unsigned int *num_stations_per_line,
+        unsigned int num_ticks)
+{
+    if (num_ticks > STATION_WAIT_TIME_MAX) {
+        return 0;
+    }
+
+    for (unsigned int i = 0; i < NUM_LINES; i++) {
+        if (num_stations_per_line[i] > (TRAIN_MAX_NODES / 2)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+#endif
+
 unsigned int* get_num_trains_per_line(unsigned int num_lines)
 {
     unsigned int* num_trains_per_line = NULL;